@@ -1,5 +1,6 @@
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 
 #include "../parse_int.h"
 
@@ -39,6 +40,32 @@ const char *VECTORS[152] = {
 
 int main() {
   unsigned long long sum = 0;
+#if defined(USE_MANY) || defined(USE_AGGREGATE)
+  // The same numbers, but as one comma separated buffer.
+  char buffer[152 * 12];
+  size_t size = 0;
+  for (int j = 0; j < 152; j++) {
+    size_t len = strlen(VECTORS[j]);
+    memcpy(buffer + size, VECTORS[j], len);
+    size += len;
+    buffer[size++] = ',';
+  }
+#ifdef USE_AGGREGATE
+  parse_int_aggregate aggregate = PARSE_INT_AGGREGATE_INIT;
+  for (int i = 0; i < 10000000; i++) {
+    aggregate_n_u64(&aggregate, buffer, size);
+  }
+  sum = aggregate.sum;
+#else
+  // Parse into an array, then reduce.
+  uint64_t values[152];
+  for (int i = 0; i < 10000000; i++) {
+    size_t count = 152;
+    parse_many_n_u64(values, &count, buffer, size);
+    for (size_t j = 0; j < count; j++) sum += values[j];
+  }
+#endif
+#else
   for (int i = 0; i < 10000000; i++) {
     for (int j = 0; j < 152; j++) {
 #ifdef USE_STRTOL
@@ -51,6 +78,7 @@ int main() {
       sum += x;
     }
   }
+#endif
   printf("sum = %lld\n", sum);
   return 0;
 }
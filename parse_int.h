@@ -31,8 +31,8 @@
 // pointer to the end of the number.
 
 // Replace `int` with any of `unsigned`, `long`, `unsigned long`, `long_long`,
-// `unsigned_long_long`,`int32`, `uint32`, `int64`, `uint64`, `int128`, or
-// `uint128` (the last two only on 64 bit platforms, currently).
+// `unsigned_long_long`, `8`, `u8`, `16`, `u16`, `32`, `u32`, `64`, `u64`,
+// `128`, or `u128` (the last two only on 64 bit platforms, currently).
 
 // Parses up to the first char that is not integer or to null char.
 const inline char *parse_int(int *result, const char *p);
@@ -71,6 +71,65 @@ const inline char *parse_overflow_int(int *result, const char *start);
 // numeric characters.  The assumption is that this was checked previously.
 const inline char *parse_novalidate_int(int *result, const char *start, size_t size);
 
+// Parses a run of unsigned integers separated by single non-digit delimiters,
+// eg. "200,404,8080,1".  On entry `*count` is the capacity of `results`, on
+// exit it is the number of integers parsed.  Returns null if a field is empty
+// or out-of-range, otherwise a pointer to the end of the last integer parsed.
+// A trailing delimiter is allowed.  Only available for `u64`.  With SSSE3,
+// several short integers are converted at once.
+const inline char *parse_many_n_u64(uint64_t *results, size_t *count, const char *start, size_t size);
+
+// Parses a run of delimited unsigned integers, as above, and writes them
+// delta encoded to `out`, either as zigzag varints or as bit packed frame-of-
+// reference blocks.  Only one block of integers is held in memory at a time.
+// The previous integer is carried in `*previous` from call to call.  On entry
+// `*out_size` is the capacity of `out`, on exit it is the number of bytes
+// written.  Returns null on parse errors, otherwise a pointer to where parsing
+// should continue.
+const inline char *parse_delta_varint_n_u64(uint8_t *out, size_t *out_size, uint64_t *previous, const char *start, size_t size);
+const inline char *parse_delta_for_n_u64(uint8_t *out, size_t *out_size, uint64_t *previous, const char *start, size_t size);
+
+// Decoders for the above.  On entry `*count` is the capacity of `results`, on
+// exit it is the number of integers decoded.  Returns null for malformed
+// input, otherwise a pointer to where decoding should continue.
+const inline uint8_t *decode_delta_varint_u64(uint64_t *results, size_t *count, uint64_t *previous, const uint8_t *in, size_t size);
+const inline uint8_t *decode_delta_for_u64(uint64_t *results, size_t *count, uint64_t *previous, const uint8_t *in, size_t size);
+
+// Parses a dotted IPv4 address with 1-3 digits per group, eg. "192.168.001.1",
+// into a 32 bit integer with the first group in the most significant byte.
+// Returns null if the address is malformed or a group is over 255, otherwise
+// a pointer to the end of the address.  Only `size` bytes are read.  With
+// SSSE3 and a size of at least 16 all four groups are validated and converted
+// from one load.
+const inline char *parse_n_ipv4(uint32_t *result, const char *p, size_t size);
+
+// As above, followed by a colon and a port number, eg. "192.168.001.1:8080".
+// The port is parsed separately with parse_n_u16.
+const inline char *parse_n_ipv4_port(uint32_t *address, uint16_t *port, const char *p, size_t size);
+
+// Running aggregates of a column of unsigned integers.  The sum is kept as
+// two 64 bit halves, so it can not overflow before 2^64 integers have been
+// added.  Start with PARSE_INT_AGGREGATE_INIT.
+typedef struct {
+  uint64_t count;
+  uint64_t min;
+  uint64_t max;
+  uint64_t sum;       // Low 64 bits of the sum.
+  uint64_t sum_high;  // High 64 bits of the sum, non-zero after overflow.
+} parse_int_aggregate;
+
+#define PARSE_INT_AGGREGATE_INIT {0, UINT64_MAX, 0, 0, 0}
+
+// Parses a run of delimited unsigned integers, as parse_many_n_u64, and folds
+// them into running aggregates without storing them.  The first adds them to
+// the count, min, max and 128 bit sum in `*aggregate`, which starts as
+// PARSE_INT_AGGREGATE_INIT.  The second counts them in `buckets` by
+// `value >> bucket_shift`.  Return as parse_many_n_u64.  On errors the
+// aggregate is unchanged, but the buckets include the integers before the
+// error.  A zero bucket count or a shift of 64 or more is an error.
+const inline char *aggregate_n_u64(parse_int_aggregate *aggregate, const char *p, size_t size);
+const inline char *aggregate_histogram_n_u64(uint64_t *buckets, size_t bucket_count, unsigned bucket_shift, const char *p, size_t size);
+
 // The 16-bytes-at-a-time mode uses the full 128 bit width of an SSE2 register.
 // Unfortunately it's hard to do shift operations over 128 bits and it's slower
 // than the non-SSE 64 bit mode.
@@ -292,7 +351,7 @@ inline _WORD _CALCULATE_BASE_10(_CHUNK bytes) {
 
 #endif
 
-#define _MAX_DIGITS(type, is_unsigned) (sizeof(type) == 4 ? 10 : (sizeof(type) == 8 ? (is_unsigned ? 20 : 19) : 39))
+#define _MAX_DIGITS(type, is_unsigned) (sizeof(type) == 1 ? 3 : sizeof(type) == 2 ? 5 : sizeof(type) == 4 ? 10 : (sizeof(type) == 8 ? (is_unsigned ? 20 : 19) : 39))
 
 _WORD _POWERS_OF_10(_WORD exponent);
 inline _WORD _POWERS_OF_10(_WORD exponent) {
@@ -332,7 +391,10 @@ inline const char *name##_##width declare_args {                             \
   _DEFINE_STATIC_CONSTS;                                                     \
   if (check_overflow && has_size) {                                          \
     if (end - p < _MAX_DIGITS(type, is_unsigned)) {                          \
-      if (check_input) return parse_nooverflow_##width(result, p, end - p);  \
+      if (check_input) {                                                     \
+        if (is_exact) return parse_nooverflow_##width(result, p, end - p);   \
+        return _parse_n_nooverflow_##width(result, p, end - p);              \
+      }                                                                      \
       return parse_nocheck_##width(result, p, end - p);                      \
     }                                                                        \
   }                                                                          \
@@ -411,7 +473,7 @@ inline const char *name##_##width declare_args {                             \
     }                                                                        \
     if (p >= end) {                                                          \
       if (check_overflow) {                                                  \
-        if (_UNLIKELY(end - digits_start > _MAX_DIGITS(utype, is_unsigned))) {            \
+        if (_UNLIKELY(end - digits_start > _MAX_DIGITS(type, is_unsigned))) {             \
           /* We may have an overflow.  We need to check how many leading  */ \
           /* zeros there were to be sure.  This path is not very          */ \
           /* optimized - normally we don't have overflows or large        */ \
@@ -420,18 +482,22 @@ inline const char *name##_##width declare_args {                             \
             if (*digits_start != '0') break;                                 \
           }                                                                  \
           if (_UNLIKELY(end - digits_start >                                 \
-                        _MAX_DIGITS(utype, is_unsigned))) {                  \
+                        _MAX_DIGITS(type, is_unsigned))) {                   \
             return NULL;                                                     \
           }                                                                  \
         }                                                                    \
       }                                                                      \
       if (is_unsigned) {                                                     \
+        /* Types narrower than utype have a final range check.            */ \
+        if (check_overflow && sizeof(type) < sizeof(utype) &&                \
+            _UNLIKELY(r > (utype)(type)-1)) {                                \
+          return NULL;                                                       \
+        }                                                                    \
         *result = (type)r;                                                   \
       } else if (!check_overflow) {                                          \
         *result = negative ? -r : r;                                         \
       } else {                                                               \
-        utype max = 0;                                                       \
-        max = (max - 1) >> 1;                                                \
+        utype max = ((utype)1 << (sizeof(type) * 8 - 1)) - 1;                \
         if (negative) {                                                      \
           if (_UNLIKELY(r > max + 1)) return NULL;                           \
           *result = -r;                                                      \
@@ -448,16 +514,20 @@ inline const char *name##_##width declare_args {                             \
   }                                                                          \
 }
 
+// _parse_n_nooverflow is what parse_n uses for inputs too short to overflow.
+// Unlike parse_nooverflow it stops at the first non-digit.
 #define _SET(width, type, utype, is_unsigned)        \
   /*                                                          null-terminated exact  has_size check_overflow check_input */ \
   _DECLARE(parse_nooverflow, width, type,                                                                           (type *result, const char *p, size_t size)) \
   _DECLARE(parse_nocheck,    width, type,                                                                           (type *result, const char *p, size_t size)) \
+  _DECLARE(_parse_n_nooverflow, width, type,                                                                        (type *result, const char *p, size_t size)) \
   _DEFINE (parse,            width, type, utype, is_unsigned, false,          false, false,   true,          true,  (type *result, const char *p), const char *end = (const char*)0 - 1;) \
   _DEFINE (parse_all,        width, type, utype, is_unsigned, true,           true,  false,   true,          true,  (type *result, const char *p), const char *end = (const char*)0 - 1;) \
   _DEFINE (parse_n,          width, type, utype, is_unsigned, false,          false, true,    true,          true,  (type *result, const char *p, size_t size), const char* end = p + size; ) \
   _DEFINE (parse_all_n,      width, type, utype, is_unsigned, false,          true,  true,    true,          true,  (type *result, const char *p, size_t size), const char* end = p + size; ) \
   _DEFINE (parse_overflow,   width, type, utype, is_unsigned, false,          false, false,   false,         true,  (type *result, const char *p), const char* end = (const char*)0 - 1; ) \
   _DEFINE (parse_nooverflow, width, type, utype, is_unsigned, false,          true,  true,    false,         true,  (type *result, const char *p, size_t size), const char* end = p + size; ) \
+  _DEFINE (_parse_n_nooverflow, width, type, utype, is_unsigned, false,       false, true,    false,         true,  (type *result, const char *p, size_t size), const char* end = p + size; ) \
   _DEFINE (parse_novalidate, width, type, utype, is_unsigned, false,          false, true,    true,          false, (type *result, const char *p, size_t size), const char* end = p + size; ) \
   _DEFINE (parse_nocheck,    width, type, utype, is_unsigned, false,          false, true,    false,         false, (type *result, const char *p, size_t size), const char* end = p + size; )
 
@@ -467,6 +537,12 @@ _SET(long_long, long long, unsigned long long, false)
 _SET(unsigned, unsigned, unsigned, true)
 _SET(unsigned_long, unsigned long, unsigned long, true)
 _SET(unsigned_long_long, unsigned long long, unsigned long long, true)
+// The 8 and 16 bit types do their arithmetic in unsigned.  Overflow is caught
+// by the digit count limit for the narrow type and a final range check.
+_SET(8, int8_t, unsigned, false)
+_SET(u8, uint8_t, unsigned, true)
+_SET(16, int16_t, unsigned, false)
+_SET(u16, uint16_t, unsigned, true)
 _SET(32, int32_t, uint32_t, false)
 _SET(u32, uint32_t, uint32_t, true)
 _SET(64, int64_t, uint64_t, false)
@@ -476,12 +552,859 @@ _SET(128, __int128, unsigned __int128, false)
 _SET(u128, unsigned __int128, unsigned __int128, true)
 #endif
 
+#if defined(__SSSE3__)
+
+// Tables for parsing several short integers at once.  They are indexed by a
+// map of the non-digits in an 8 byte window that starts at a digit.  Each
+// integer of 1-4 digits that is terminated by a delimiter inside the window is
+// gathered into its own 32 bit lane, right aligned and with leading zeros.  The
+// info byte has the number of integers in the low nibble and the number of
+// bytes consumed, including the last delimiter, in the high nibble.  A zero
+// entry means the window starts with an empty field or an integer that is too
+// long, and the slow path must handle it.
+//
+// The entry for a map is built like this, with bit i of the map set if byte i
+// of the window is not a digit:
+//
+//   start = 0, count = 0, consumed = 0, all shuffle bytes 0x80 (zero)
+//   while count < 4 and bit `start` of the map is clear:
+//     end = index of the first set bit above `start`, stop if there is none
+//     length = end - start, stop if it is over 4
+//     for i in 0 .. length - 1:
+//       shuffle byte 4 * count + 3 - i = end - 1 - i
+//     count += 1, consumed = end + 1, start = end + 1
+//   info = consumed << 4 | count
+//
+// The comment on each shuffle is the map, most significant bit first.
+
+__m128i _GET_SHORT_SHUFFLE(unsigned map);
+inline __m128i _GET_SHORT_SHUFFLE(unsigned map) {
+  static const __m128i shuffles[256] = {
+      {(int64_t)0x8080808080808080L, (int64_t)0x8080808080808080L},  // 00000000
+      {(int64_t)0x8080808080808080L, (int64_t)0x8080808080808080L},  // 00000001
+      {(int64_t)0x8080808000808080L, (int64_t)0x8080808080808080L},  // 00000010
+      {(int64_t)0x8080808080808080L, (int64_t)0x8080808080808080L},  // 00000011
+      {(int64_t)0x8080808001008080L, (int64_t)0x8080808080808080L},  // 00000100
+      {(int64_t)0x8080808080808080L, (int64_t)0x8080808080808080L},  // 00000101
+      {(int64_t)0x8080808000808080L, (int64_t)0x8080808080808080L},  // 00000110
+      {(int64_t)0x8080808080808080L, (int64_t)0x8080808080808080L},  // 00000111
+      {(int64_t)0x8080808002010080L, (int64_t)0x8080808080808080L},  // 00001000
+      {(int64_t)0x8080808080808080L, (int64_t)0x8080808080808080L},  // 00001001
+      {(int64_t)0x0280808000808080L, (int64_t)0x8080808080808080L},  // 00001010
+      {(int64_t)0x8080808080808080L, (int64_t)0x8080808080808080L},  // 00001011
+      {(int64_t)0x8080808001008080L, (int64_t)0x8080808080808080L},  // 00001100
+      {(int64_t)0x8080808080808080L, (int64_t)0x8080808080808080L},  // 00001101
+      {(int64_t)0x8080808000808080L, (int64_t)0x8080808080808080L},  // 00001110
+      {(int64_t)0x8080808080808080L, (int64_t)0x8080808080808080L},  // 00001111
+      {(int64_t)0x8080808003020100L, (int64_t)0x8080808080808080L},  // 00010000
+      {(int64_t)0x8080808080808080L, (int64_t)0x8080808080808080L},  // 00010001
+      {(int64_t)0x0302808000808080L, (int64_t)0x8080808080808080L},  // 00010010
+      {(int64_t)0x8080808080808080L, (int64_t)0x8080808080808080L},  // 00010011
+      {(int64_t)0x0380808001008080L, (int64_t)0x8080808080808080L},  // 00010100
+      {(int64_t)0x8080808080808080L, (int64_t)0x8080808080808080L},  // 00010101
+      {(int64_t)0x8080808000808080L, (int64_t)0x8080808080808080L},  // 00010110
+      {(int64_t)0x8080808080808080L, (int64_t)0x8080808080808080L},  // 00010111
+      {(int64_t)0x8080808002010080L, (int64_t)0x8080808080808080L},  // 00011000
+      {(int64_t)0x8080808080808080L, (int64_t)0x8080808080808080L},  // 00011001
+      {(int64_t)0x0280808000808080L, (int64_t)0x8080808080808080L},  // 00011010
+      {(int64_t)0x8080808080808080L, (int64_t)0x8080808080808080L},  // 00011011
+      {(int64_t)0x8080808001008080L, (int64_t)0x8080808080808080L},  // 00011100
+      {(int64_t)0x8080808080808080L, (int64_t)0x8080808080808080L},  // 00011101
+      {(int64_t)0x8080808000808080L, (int64_t)0x8080808080808080L},  // 00011110
+      {(int64_t)0x8080808080808080L, (int64_t)0x8080808080808080L},  // 00011111
+      {(int64_t)0x8080808080808080L, (int64_t)0x8080808080808080L},  // 00100000
+      {(int64_t)0x8080808080808080L, (int64_t)0x8080808080808080L},  // 00100001
+      {(int64_t)0x0403028000808080L, (int64_t)0x8080808080808080L},  // 00100010
+      {(int64_t)0x8080808080808080L, (int64_t)0x8080808080808080L},  // 00100011
+      {(int64_t)0x0403808001008080L, (int64_t)0x8080808080808080L},  // 00100100
+      {(int64_t)0x8080808080808080L, (int64_t)0x8080808080808080L},  // 00100101
+      {(int64_t)0x8080808000808080L, (int64_t)0x8080808080808080L},  // 00100110
+      {(int64_t)0x8080808080808080L, (int64_t)0x8080808080808080L},  // 00100111
+      {(int64_t)0x0480808002010080L, (int64_t)0x8080808080808080L},  // 00101000
+      {(int64_t)0x8080808080808080L, (int64_t)0x8080808080808080L},  // 00101001
+      {(int64_t)0x0280808000808080L, (int64_t)0x8080808004808080L},  // 00101010
+      {(int64_t)0x8080808080808080L, (int64_t)0x8080808080808080L},  // 00101011
+      {(int64_t)0x8080808001008080L, (int64_t)0x8080808080808080L},  // 00101100
+      {(int64_t)0x8080808080808080L, (int64_t)0x8080808080808080L},  // 00101101
+      {(int64_t)0x8080808000808080L, (int64_t)0x8080808080808080L},  // 00101110
+      {(int64_t)0x8080808080808080L, (int64_t)0x8080808080808080L},  // 00101111
+      {(int64_t)0x8080808003020100L, (int64_t)0x8080808080808080L},  // 00110000
+      {(int64_t)0x8080808080808080L, (int64_t)0x8080808080808080L},  // 00110001
+      {(int64_t)0x0302808000808080L, (int64_t)0x8080808080808080L},  // 00110010
+      {(int64_t)0x8080808080808080L, (int64_t)0x8080808080808080L},  // 00110011
+      {(int64_t)0x0380808001008080L, (int64_t)0x8080808080808080L},  // 00110100
+      {(int64_t)0x8080808080808080L, (int64_t)0x8080808080808080L},  // 00110101
+      {(int64_t)0x8080808000808080L, (int64_t)0x8080808080808080L},  // 00110110
+      {(int64_t)0x8080808080808080L, (int64_t)0x8080808080808080L},  // 00110111
+      {(int64_t)0x8080808002010080L, (int64_t)0x8080808080808080L},  // 00111000
+      {(int64_t)0x8080808080808080L, (int64_t)0x8080808080808080L},  // 00111001
+      {(int64_t)0x0280808000808080L, (int64_t)0x8080808080808080L},  // 00111010
+      {(int64_t)0x8080808080808080L, (int64_t)0x8080808080808080L},  // 00111011
+      {(int64_t)0x8080808001008080L, (int64_t)0x8080808080808080L},  // 00111100
+      {(int64_t)0x8080808080808080L, (int64_t)0x8080808080808080L},  // 00111101
+      {(int64_t)0x8080808000808080L, (int64_t)0x8080808080808080L},  // 00111110
+      {(int64_t)0x8080808080808080L, (int64_t)0x8080808080808080L},  // 00111111
+      {(int64_t)0x8080808080808080L, (int64_t)0x8080808080808080L},  // 01000000
+      {(int64_t)0x8080808080808080L, (int64_t)0x8080808080808080L},  // 01000001
+      {(int64_t)0x0504030200808080L, (int64_t)0x8080808080808080L},  // 01000010
+      {(int64_t)0x8080808080808080L, (int64_t)0x8080808080808080L},  // 01000011
+      {(int64_t)0x0504038001008080L, (int64_t)0x8080808080808080L},  // 01000100
+      {(int64_t)0x8080808080808080L, (int64_t)0x8080808080808080L},  // 01000101
+      {(int64_t)0x8080808000808080L, (int64_t)0x8080808080808080L},  // 01000110
+      {(int64_t)0x8080808080808080L, (int64_t)0x8080808080808080L},  // 01000111
+      {(int64_t)0x0504808002010080L, (int64_t)0x8080808080808080L},  // 01001000
+      {(int64_t)0x8080808080808080L, (int64_t)0x8080808080808080L},  // 01001001
+      {(int64_t)0x0280808000808080L, (int64_t)0x8080808005048080L},  // 01001010
+      {(int64_t)0x8080808080808080L, (int64_t)0x8080808080808080L},  // 01001011
+      {(int64_t)0x8080808001008080L, (int64_t)0x8080808080808080L},  // 01001100
+      {(int64_t)0x8080808080808080L, (int64_t)0x8080808080808080L},  // 01001101
+      {(int64_t)0x8080808000808080L, (int64_t)0x8080808080808080L},  // 01001110
+      {(int64_t)0x8080808080808080L, (int64_t)0x8080808080808080L},  // 01001111
+      {(int64_t)0x0580808003020100L, (int64_t)0x8080808080808080L},  // 01010000
+      {(int64_t)0x8080808080808080L, (int64_t)0x8080808080808080L},  // 01010001
+      {(int64_t)0x0302808000808080L, (int64_t)0x8080808005808080L},  // 01010010
+      {(int64_t)0x8080808080808080L, (int64_t)0x8080808080808080L},  // 01010011
+      {(int64_t)0x0380808001008080L, (int64_t)0x8080808005808080L},  // 01010100
+      {(int64_t)0x8080808080808080L, (int64_t)0x8080808080808080L},  // 01010101
+      {(int64_t)0x8080808000808080L, (int64_t)0x8080808080808080L},  // 01010110
+      {(int64_t)0x8080808080808080L, (int64_t)0x8080808080808080L},  // 01010111
+      {(int64_t)0x8080808002010080L, (int64_t)0x8080808080808080L},  // 01011000
+      {(int64_t)0x8080808080808080L, (int64_t)0x8080808080808080L},  // 01011001
+      {(int64_t)0x0280808000808080L, (int64_t)0x8080808080808080L},  // 01011010
+      {(int64_t)0x8080808080808080L, (int64_t)0x8080808080808080L},  // 01011011
+      {(int64_t)0x8080808001008080L, (int64_t)0x8080808080808080L},  // 01011100
+      {(int64_t)0x8080808080808080L, (int64_t)0x8080808080808080L},  // 01011101
+      {(int64_t)0x8080808000808080L, (int64_t)0x8080808080808080L},  // 01011110
+      {(int64_t)0x8080808080808080L, (int64_t)0x8080808080808080L},  // 01011111
+      {(int64_t)0x8080808080808080L, (int64_t)0x8080808080808080L},  // 01100000
+      {(int64_t)0x8080808080808080L, (int64_t)0x8080808080808080L},  // 01100001
+      {(int64_t)0x0403028000808080L, (int64_t)0x8080808080808080L},  // 01100010
+      {(int64_t)0x8080808080808080L, (int64_t)0x8080808080808080L},  // 01100011
+      {(int64_t)0x0403808001008080L, (int64_t)0x8080808080808080L},  // 01100100
+      {(int64_t)0x8080808080808080L, (int64_t)0x8080808080808080L},  // 01100101
+      {(int64_t)0x8080808000808080L, (int64_t)0x8080808080808080L},  // 01100110
+      {(int64_t)0x8080808080808080L, (int64_t)0x8080808080808080L},  // 01100111
+      {(int64_t)0x0480808002010080L, (int64_t)0x8080808080808080L},  // 01101000
+      {(int64_t)0x8080808080808080L, (int64_t)0x8080808080808080L},  // 01101001
+      {(int64_t)0x0280808000808080L, (int64_t)0x8080808004808080L},  // 01101010
+      {(int64_t)0x8080808080808080L, (int64_t)0x8080808080808080L},  // 01101011
+      {(int64_t)0x8080808001008080L, (int64_t)0x8080808080808080L},  // 01101100
+      {(int64_t)0x8080808080808080L, (int64_t)0x8080808080808080L},  // 01101101
+      {(int64_t)0x8080808000808080L, (int64_t)0x8080808080808080L},  // 01101110
+      {(int64_t)0x8080808080808080L, (int64_t)0x8080808080808080L},  // 01101111
+      {(int64_t)0x8080808003020100L, (int64_t)0x8080808080808080L},  // 01110000
+      {(int64_t)0x8080808080808080L, (int64_t)0x8080808080808080L},  // 01110001
+      {(int64_t)0x0302808000808080L, (int64_t)0x8080808080808080L},  // 01110010
+      {(int64_t)0x8080808080808080L, (int64_t)0x8080808080808080L},  // 01110011
+      {(int64_t)0x0380808001008080L, (int64_t)0x8080808080808080L},  // 01110100
+      {(int64_t)0x8080808080808080L, (int64_t)0x8080808080808080L},  // 01110101
+      {(int64_t)0x8080808000808080L, (int64_t)0x8080808080808080L},  // 01110110
+      {(int64_t)0x8080808080808080L, (int64_t)0x8080808080808080L},  // 01110111
+      {(int64_t)0x8080808002010080L, (int64_t)0x8080808080808080L},  // 01111000
+      {(int64_t)0x8080808080808080L, (int64_t)0x8080808080808080L},  // 01111001
+      {(int64_t)0x0280808000808080L, (int64_t)0x8080808080808080L},  // 01111010
+      {(int64_t)0x8080808080808080L, (int64_t)0x8080808080808080L},  // 01111011
+      {(int64_t)0x8080808001008080L, (int64_t)0x8080808080808080L},  // 01111100
+      {(int64_t)0x8080808080808080L, (int64_t)0x8080808080808080L},  // 01111101
+      {(int64_t)0x8080808000808080L, (int64_t)0x8080808080808080L},  // 01111110
+      {(int64_t)0x8080808080808080L, (int64_t)0x8080808080808080L},  // 01111111
+      {(int64_t)0x8080808080808080L, (int64_t)0x8080808080808080L},  // 10000000
+      {(int64_t)0x8080808080808080L, (int64_t)0x8080808080808080L},  // 10000001
+      {(int64_t)0x8080808000808080L, (int64_t)0x8080808080808080L},  // 10000010
+      {(int64_t)0x8080808080808080L, (int64_t)0x8080808080808080L},  // 10000011
+      {(int64_t)0x0605040301008080L, (int64_t)0x8080808080808080L},  // 10000100
+      {(int64_t)0x8080808080808080L, (int64_t)0x8080808080808080L},  // 10000101
+      {(int64_t)0x8080808000808080L, (int64_t)0x8080808080808080L},  // 10000110
+      {(int64_t)0x8080808080808080L, (int64_t)0x8080808080808080L},  // 10000111
+      {(int64_t)0x0605048002010080L, (int64_t)0x8080808080808080L},  // 10001000
+      {(int64_t)0x8080808080808080L, (int64_t)0x8080808080808080L},  // 10001001
+      {(int64_t)0x0280808000808080L, (int64_t)0x8080808006050480L},  // 10001010
+      {(int64_t)0x8080808080808080L, (int64_t)0x8080808080808080L},  // 10001011
+      {(int64_t)0x8080808001008080L, (int64_t)0x8080808080808080L},  // 10001100
+      {(int64_t)0x8080808080808080L, (int64_t)0x8080808080808080L},  // 10001101
+      {(int64_t)0x8080808000808080L, (int64_t)0x8080808080808080L},  // 10001110
+      {(int64_t)0x8080808080808080L, (int64_t)0x8080808080808080L},  // 10001111
+      {(int64_t)0x0605808003020100L, (int64_t)0x8080808080808080L},  // 10010000
+      {(int64_t)0x8080808080808080L, (int64_t)0x8080808080808080L},  // 10010001
+      {(int64_t)0x0302808000808080L, (int64_t)0x8080808006058080L},  // 10010010
+      {(int64_t)0x8080808080808080L, (int64_t)0x8080808080808080L},  // 10010011
+      {(int64_t)0x0380808001008080L, (int64_t)0x8080808006058080L},  // 10010100
+      {(int64_t)0x8080808080808080L, (int64_t)0x8080808080808080L},  // 10010101
+      {(int64_t)0x8080808000808080L, (int64_t)0x8080808080808080L},  // 10010110
+      {(int64_t)0x8080808080808080L, (int64_t)0x8080808080808080L},  // 10010111
+      {(int64_t)0x8080808002010080L, (int64_t)0x8080808080808080L},  // 10011000
+      {(int64_t)0x8080808080808080L, (int64_t)0x8080808080808080L},  // 10011001
+      {(int64_t)0x0280808000808080L, (int64_t)0x8080808080808080L},  // 10011010
+      {(int64_t)0x8080808080808080L, (int64_t)0x8080808080808080L},  // 10011011
+      {(int64_t)0x8080808001008080L, (int64_t)0x8080808080808080L},  // 10011100
+      {(int64_t)0x8080808080808080L, (int64_t)0x8080808080808080L},  // 10011101
+      {(int64_t)0x8080808000808080L, (int64_t)0x8080808080808080L},  // 10011110
+      {(int64_t)0x8080808080808080L, (int64_t)0x8080808080808080L},  // 10011111
+      {(int64_t)0x8080808080808080L, (int64_t)0x8080808080808080L},  // 10100000
+      {(int64_t)0x8080808080808080L, (int64_t)0x8080808080808080L},  // 10100001
+      {(int64_t)0x0403028000808080L, (int64_t)0x8080808006808080L},  // 10100010
+      {(int64_t)0x8080808080808080L, (int64_t)0x8080808080808080L},  // 10100011
+      {(int64_t)0x0403808001008080L, (int64_t)0x8080808006808080L},  // 10100100
+      {(int64_t)0x8080808080808080L, (int64_t)0x8080808080808080L},  // 10100101
+      {(int64_t)0x8080808000808080L, (int64_t)0x8080808080808080L},  // 10100110
+      {(int64_t)0x8080808080808080L, (int64_t)0x8080808080808080L},  // 10100111
+      {(int64_t)0x0480808002010080L, (int64_t)0x8080808006808080L},  // 10101000
+      {(int64_t)0x8080808080808080L, (int64_t)0x8080808080808080L},  // 10101001
+      {(int64_t)0x0280808000808080L, (int64_t)0x0680808004808080L},  // 10101010
+      {(int64_t)0x8080808080808080L, (int64_t)0x8080808080808080L},  // 10101011
+      {(int64_t)0x8080808001008080L, (int64_t)0x8080808080808080L},  // 10101100
+      {(int64_t)0x8080808080808080L, (int64_t)0x8080808080808080L},  // 10101101
+      {(int64_t)0x8080808000808080L, (int64_t)0x8080808080808080L},  // 10101110
+      {(int64_t)0x8080808080808080L, (int64_t)0x8080808080808080L},  // 10101111
+      {(int64_t)0x8080808003020100L, (int64_t)0x8080808080808080L},  // 10110000
+      {(int64_t)0x8080808080808080L, (int64_t)0x8080808080808080L},  // 10110001
+      {(int64_t)0x0302808000808080L, (int64_t)0x8080808080808080L},  // 10110010
+      {(int64_t)0x8080808080808080L, (int64_t)0x8080808080808080L},  // 10110011
+      {(int64_t)0x0380808001008080L, (int64_t)0x8080808080808080L},  // 10110100
+      {(int64_t)0x8080808080808080L, (int64_t)0x8080808080808080L},  // 10110101
+      {(int64_t)0x8080808000808080L, (int64_t)0x8080808080808080L},  // 10110110
+      {(int64_t)0x8080808080808080L, (int64_t)0x8080808080808080L},  // 10110111
+      {(int64_t)0x8080808002010080L, (int64_t)0x8080808080808080L},  // 10111000
+      {(int64_t)0x8080808080808080L, (int64_t)0x8080808080808080L},  // 10111001
+      {(int64_t)0x0280808000808080L, (int64_t)0x8080808080808080L},  // 10111010
+      {(int64_t)0x8080808080808080L, (int64_t)0x8080808080808080L},  // 10111011
+      {(int64_t)0x8080808001008080L, (int64_t)0x8080808080808080L},  // 10111100
+      {(int64_t)0x8080808080808080L, (int64_t)0x8080808080808080L},  // 10111101
+      {(int64_t)0x8080808000808080L, (int64_t)0x8080808080808080L},  // 10111110
+      {(int64_t)0x8080808080808080L, (int64_t)0x8080808080808080L},  // 10111111
+      {(int64_t)0x8080808080808080L, (int64_t)0x8080808080808080L},  // 11000000
+      {(int64_t)0x8080808080808080L, (int64_t)0x8080808080808080L},  // 11000001
+      {(int64_t)0x0504030200808080L, (int64_t)0x8080808080808080L},  // 11000010
+      {(int64_t)0x8080808080808080L, (int64_t)0x8080808080808080L},  // 11000011
+      {(int64_t)0x0504038001008080L, (int64_t)0x8080808080808080L},  // 11000100
+      {(int64_t)0x8080808080808080L, (int64_t)0x8080808080808080L},  // 11000101
+      {(int64_t)0x8080808000808080L, (int64_t)0x8080808080808080L},  // 11000110
+      {(int64_t)0x8080808080808080L, (int64_t)0x8080808080808080L},  // 11000111
+      {(int64_t)0x0504808002010080L, (int64_t)0x8080808080808080L},  // 11001000
+      {(int64_t)0x8080808080808080L, (int64_t)0x8080808080808080L},  // 11001001
+      {(int64_t)0x0280808000808080L, (int64_t)0x8080808005048080L},  // 11001010
+      {(int64_t)0x8080808080808080L, (int64_t)0x8080808080808080L},  // 11001011
+      {(int64_t)0x8080808001008080L, (int64_t)0x8080808080808080L},  // 11001100
+      {(int64_t)0x8080808080808080L, (int64_t)0x8080808080808080L},  // 11001101
+      {(int64_t)0x8080808000808080L, (int64_t)0x8080808080808080L},  // 11001110
+      {(int64_t)0x8080808080808080L, (int64_t)0x8080808080808080L},  // 11001111
+      {(int64_t)0x0580808003020100L, (int64_t)0x8080808080808080L},  // 11010000
+      {(int64_t)0x8080808080808080L, (int64_t)0x8080808080808080L},  // 11010001
+      {(int64_t)0x0302808000808080L, (int64_t)0x8080808005808080L},  // 11010010
+      {(int64_t)0x8080808080808080L, (int64_t)0x8080808080808080L},  // 11010011
+      {(int64_t)0x0380808001008080L, (int64_t)0x8080808005808080L},  // 11010100
+      {(int64_t)0x8080808080808080L, (int64_t)0x8080808080808080L},  // 11010101
+      {(int64_t)0x8080808000808080L, (int64_t)0x8080808080808080L},  // 11010110
+      {(int64_t)0x8080808080808080L, (int64_t)0x8080808080808080L},  // 11010111
+      {(int64_t)0x8080808002010080L, (int64_t)0x8080808080808080L},  // 11011000
+      {(int64_t)0x8080808080808080L, (int64_t)0x8080808080808080L},  // 11011001
+      {(int64_t)0x0280808000808080L, (int64_t)0x8080808080808080L},  // 11011010
+      {(int64_t)0x8080808080808080L, (int64_t)0x8080808080808080L},  // 11011011
+      {(int64_t)0x8080808001008080L, (int64_t)0x8080808080808080L},  // 11011100
+      {(int64_t)0x8080808080808080L, (int64_t)0x8080808080808080L},  // 11011101
+      {(int64_t)0x8080808000808080L, (int64_t)0x8080808080808080L},  // 11011110
+      {(int64_t)0x8080808080808080L, (int64_t)0x8080808080808080L},  // 11011111
+      {(int64_t)0x8080808080808080L, (int64_t)0x8080808080808080L},  // 11100000
+      {(int64_t)0x8080808080808080L, (int64_t)0x8080808080808080L},  // 11100001
+      {(int64_t)0x0403028000808080L, (int64_t)0x8080808080808080L},  // 11100010
+      {(int64_t)0x8080808080808080L, (int64_t)0x8080808080808080L},  // 11100011
+      {(int64_t)0x0403808001008080L, (int64_t)0x8080808080808080L},  // 11100100
+      {(int64_t)0x8080808080808080L, (int64_t)0x8080808080808080L},  // 11100101
+      {(int64_t)0x8080808000808080L, (int64_t)0x8080808080808080L},  // 11100110
+      {(int64_t)0x8080808080808080L, (int64_t)0x8080808080808080L},  // 11100111
+      {(int64_t)0x0480808002010080L, (int64_t)0x8080808080808080L},  // 11101000
+      {(int64_t)0x8080808080808080L, (int64_t)0x8080808080808080L},  // 11101001
+      {(int64_t)0x0280808000808080L, (int64_t)0x8080808004808080L},  // 11101010
+      {(int64_t)0x8080808080808080L, (int64_t)0x8080808080808080L},  // 11101011
+      {(int64_t)0x8080808001008080L, (int64_t)0x8080808080808080L},  // 11101100
+      {(int64_t)0x8080808080808080L, (int64_t)0x8080808080808080L},  // 11101101
+      {(int64_t)0x8080808000808080L, (int64_t)0x8080808080808080L},  // 11101110
+      {(int64_t)0x8080808080808080L, (int64_t)0x8080808080808080L},  // 11101111
+      {(int64_t)0x8080808003020100L, (int64_t)0x8080808080808080L},  // 11110000
+      {(int64_t)0x8080808080808080L, (int64_t)0x8080808080808080L},  // 11110001
+      {(int64_t)0x0302808000808080L, (int64_t)0x8080808080808080L},  // 11110010
+      {(int64_t)0x8080808080808080L, (int64_t)0x8080808080808080L},  // 11110011
+      {(int64_t)0x0380808001008080L, (int64_t)0x8080808080808080L},  // 11110100
+      {(int64_t)0x8080808080808080L, (int64_t)0x8080808080808080L},  // 11110101
+      {(int64_t)0x8080808000808080L, (int64_t)0x8080808080808080L},  // 11110110
+      {(int64_t)0x8080808080808080L, (int64_t)0x8080808080808080L},  // 11110111
+      {(int64_t)0x8080808002010080L, (int64_t)0x8080808080808080L},  // 11111000
+      {(int64_t)0x8080808080808080L, (int64_t)0x8080808080808080L},  // 11111001
+      {(int64_t)0x0280808000808080L, (int64_t)0x8080808080808080L},  // 11111010
+      {(int64_t)0x8080808080808080L, (int64_t)0x8080808080808080L},  // 11111011
+      {(int64_t)0x8080808001008080L, (int64_t)0x8080808080808080L},  // 11111100
+      {(int64_t)0x8080808080808080L, (int64_t)0x8080808080808080L},  // 11111101
+      {(int64_t)0x8080808000808080L, (int64_t)0x8080808080808080L},  // 11111110
+      {(int64_t)0x8080808080808080L, (int64_t)0x8080808080808080L},  // 11111111
+  };
+  return shuffles[map];
+}
+
+uint8_t _GET_SHORT_INFO(unsigned map);
+inline uint8_t _GET_SHORT_INFO(unsigned map) {
+  static const uint8_t info[256] = {
+      0x00, 0x00, 0x21, 0x00, 0x31, 0x00, 0x21, 0x00, 0x41, 0x00, 0x42, 0x00, 0x31, 0x00, 0x21, 0x00,
+      0x51, 0x00, 0x52, 0x00, 0x52, 0x00, 0x21, 0x00, 0x41, 0x00, 0x42, 0x00, 0x31, 0x00, 0x21, 0x00,
+      0x00, 0x00, 0x62, 0x00, 0x62, 0x00, 0x21, 0x00, 0x62, 0x00, 0x63, 0x00, 0x31, 0x00, 0x21, 0x00,
+      0x51, 0x00, 0x52, 0x00, 0x52, 0x00, 0x21, 0x00, 0x41, 0x00, 0x42, 0x00, 0x31, 0x00, 0x21, 0x00,
+      0x00, 0x00, 0x72, 0x00, 0x72, 0x00, 0x21, 0x00, 0x72, 0x00, 0x73, 0x00, 0x31, 0x00, 0x21, 0x00,
+      0x72, 0x00, 0x73, 0x00, 0x73, 0x00, 0x21, 0x00, 0x41, 0x00, 0x42, 0x00, 0x31, 0x00, 0x21, 0x00,
+      0x00, 0x00, 0x62, 0x00, 0x62, 0x00, 0x21, 0x00, 0x62, 0x00, 0x63, 0x00, 0x31, 0x00, 0x21, 0x00,
+      0x51, 0x00, 0x52, 0x00, 0x52, 0x00, 0x21, 0x00, 0x41, 0x00, 0x42, 0x00, 0x31, 0x00, 0x21, 0x00,
+      0x00, 0x00, 0x21, 0x00, 0x82, 0x00, 0x21, 0x00, 0x82, 0x00, 0x83, 0x00, 0x31, 0x00, 0x21, 0x00,
+      0x82, 0x00, 0x83, 0x00, 0x83, 0x00, 0x21, 0x00, 0x41, 0x00, 0x42, 0x00, 0x31, 0x00, 0x21, 0x00,
+      0x00, 0x00, 0x83, 0x00, 0x83, 0x00, 0x21, 0x00, 0x83, 0x00, 0x84, 0x00, 0x31, 0x00, 0x21, 0x00,
+      0x51, 0x00, 0x52, 0x00, 0x52, 0x00, 0x21, 0x00, 0x41, 0x00, 0x42, 0x00, 0x31, 0x00, 0x21, 0x00,
+      0x00, 0x00, 0x72, 0x00, 0x72, 0x00, 0x21, 0x00, 0x72, 0x00, 0x73, 0x00, 0x31, 0x00, 0x21, 0x00,
+      0x72, 0x00, 0x73, 0x00, 0x73, 0x00, 0x21, 0x00, 0x41, 0x00, 0x42, 0x00, 0x31, 0x00, 0x21, 0x00,
+      0x00, 0x00, 0x62, 0x00, 0x62, 0x00, 0x21, 0x00, 0x62, 0x00, 0x63, 0x00, 0x31, 0x00, 0x21, 0x00,
+      0x51, 0x00, 0x52, 0x00, 0x52, 0x00, 0x21, 0x00, 0x41, 0x00, 0x42, 0x00, 0x31, 0x00, 0x21, 0x00,
+  };
+  return info[map];
+}
+
+// Converts the integers at the start of the 8 bytes at `*p` into the 32 bit
+// lanes of `*lanes`, and advances `*p` past the last delimiter.  All 8 bytes
+// must be inside the input.  Returns the number of integers, or zero if the
+// slow path must handle the next integer.
+unsigned _PARSE_SHORT(__m128i *lanes, const char **p);
+inline unsigned _PARSE_SHORT(__m128i *lanes, const char **p) {
+  /* Unaligned load, unlike the single integer routines.                  */
+  __m128i bytes = _mm_xor_si128(_mm_loadl_epi64((const __m128i*)*p), _mm_set1_epi8('0'));
+  /* Digits are now 0-9, everything else saturates to non-zero.           */
+  __m128i is_digit = _mm_cmpeq_epi8(_mm_subs_epu8(bytes, _mm_set1_epi8(9)), _mm_setzero_si128());
+  unsigned map = ~_mm_movemask_epi8(is_digit) & 0xff;
+  uint8_t info = _GET_SHORT_INFO(map);
+  if (info == 0) return 0;
+  /* Gather the digits into four 32 bit lanes and convert them all at     */
+  /* once.  Byte pairs become 0-99, then 16 bit pairs become 0-9999.      */
+  bytes = _mm_shuffle_epi8(bytes, _GET_SHORT_SHUFFLE(map));
+  bytes = _mm_maddubs_epi16(bytes, _mm_set1_epi16(0x010a));
+  *lanes = _mm_madd_epi16(bytes, _mm_set1_epi32(0x00010064));
+  *p += info >> 4;
+  return info & 0xf;
+}
+
+#endif
+
+const char *parse_many_n_u64(uint64_t *results, size_t *count, const char *p, size_t size);
+inline const char *parse_many_n_u64(uint64_t *results, size_t *count, const char *p, size_t size) {
+  const char *end = p + size;
+  const char *last_end = p;
+  size_t capacity = *count;
+  size_t n = 0;
+  /* Integers that start before the last non-digit are sure to end before */
+  /* `end`, so they can use the parser without a size, which is faster.   */
+  const char *tail = end;
+  while (tail > p && '0' <= tail[-1] && tail[-1] <= '9') tail--;
+  while (n < capacity) {
+    if (n != 0 && p == end) break;  /* Trailing delimiter. */
+#if defined(__SSSE3__)
+    if (end - p >= 8 && capacity - n >= 4) {
+      __m128i lanes;
+      unsigned lane_count = _PARSE_SHORT(&lanes, &p);
+      if (lane_count != 0) {
+        _mm_storeu_si128((__m128i*)(results + n), _mm_unpacklo_epi32(lanes, _mm_setzero_si128()));
+        _mm_storeu_si128((__m128i*)(results + n + 2), _mm_unpackhi_epi32(lanes, _mm_setzero_si128()));
+        n += lane_count;
+        last_end = p - 1;
+        continue;
+      }
+    }
+#endif
+    /* One integer at a time.  This stops at the delimiter and checks for  */
+    /* empty fields and overflow.                                           */
+    uint64_t value = 0;
+    const char *q = p < tail ? parse_u64(&value, p) : parse_n_u64(&value, p, end - p);
+    if (!q) return NULL;
+    results[n++] = value;
+    last_end = q;
+    if (q == end) break;
+    p = q + 1;
+  }
+  *count = n;
+  return last_end;
+}
+
+// Delta encoding of delimited integer columns.  The integers are parsed a
+// block at a time with parse_many_n_u64 and encoded straight away, so only one
+// block is ever held in memory.  Each integer is stored as the difference from
+// the previous one, which is carried in `*previous` from call to call.  The
+// differences wrap around, so unsorted columns round-trip too, they just
+// compress worse.
+
+// Number of integers parsed and encoded at a time, the largest block that
+// parse_delta_for_n_u64 can write, and the largest varint.
+#define PARSE_INT_BLOCK_SIZE 128
+#define PARSE_INT_MAX_FOR_BLOCK_BYTES (10 + 8 * PARSE_INT_BLOCK_SIZE)
+#define PARSE_INT_MAX_VARINT_BYTES 10
+
+uint64_t _ZIGZAG(uint64_t delta);
+inline uint64_t _ZIGZAG(uint64_t delta) {
+  return (delta << 1) ^ (uint64_t)((int64_t)delta >> 63);
+}
+
+uint64_t _UNZIGZAG(uint64_t zigzag);
+inline uint64_t _UNZIGZAG(uint64_t zigzag) {
+  return (zigzag >> 1) ^ (0 - (zigzag & 1));
+}
+
+void _STORE_LE(uint8_t *out, uint64_t value, size_t bytes);
+inline void _STORE_LE(uint8_t *out, uint64_t value, size_t bytes) {
+  for (size_t i = 0; i < bytes; i++) out[i] = (uint8_t)(value >> (i * 8));
+}
+
+uint64_t _LOAD_LE(const uint8_t *in, size_t bytes);
+inline uint64_t _LOAD_LE(const uint8_t *in, size_t bytes) {
+  uint64_t value = 0;
+  for (size_t i = 0; i < bytes; i++) value |= (uint64_t)in[i] << (i * 8);
+  return value;
+}
+
+// Parses the next block of at most `*count` integers into `values`.  Updates
+// `*p` to where the next block starts, which is `end` once the input is used
+// up.  Returns false on parse errors.
+bool _PARSE_BLOCK(uint64_t *values, size_t *count, const char **p, const char *end);
+inline bool _PARSE_BLOCK(uint64_t *values, size_t *count, const char **p, const char *end) {
+  if (*count == 0) return true;
+  const char *last_end = parse_many_n_u64(values, count, *p, end - *p);
+  if (!last_end) return false;
+  /* Skip the delimiter, unless it was a trailing one. */
+  *p = last_end == end || last_end + 1 == end ? end : last_end + 1;
+  return true;
+}
+
+// Parses delimited unsigned integers and writes the zigzag encoded deltas as
+// LEB128 varints to `out`.  On entry `*out_size` is the capacity of `out`, on
+// exit it is the number of bytes written.  Returns null on parse errors,
+// otherwise a pointer to where parsing should continue, which is the end of
+// the input when it has all been encoded.  Only integers whose varints are
+// sure to fit are parsed, so `*out_size` must be at least
+// PARSE_INT_MAX_VARINT_BYTES to make progress.
+const char *parse_delta_varint_n_u64(uint8_t *out, size_t *out_size, uint64_t *previous, const char *p, size_t size);
+inline const char *parse_delta_varint_n_u64(uint8_t *out, size_t *out_size, uint64_t *previous, const char *p, size_t size) {
+  const char *end = p + size;
+  uint64_t values[PARSE_INT_BLOCK_SIZE];
+  size_t written = 0;
+  uint64_t last = *previous;
+  while (p < end) {
+    size_t count = (*out_size - written) / PARSE_INT_MAX_VARINT_BYTES;
+    if (count > PARSE_INT_BLOCK_SIZE) count = PARSE_INT_BLOCK_SIZE;
+    if (count == 0) break;
+    if (!_PARSE_BLOCK(values, &count, &p, end)) return NULL;
+    for (size_t i = 0; i < count; i++) {
+      uint64_t zigzag = _ZIGZAG(values[i] - last);
+      last = values[i];
+      while (zigzag >= 0x80) {
+        out[written++] = (uint8_t)(zigzag | 0x80);
+        zigzag >>= 7;
+      }
+      out[written++] = (uint8_t)zigzag;
+    }
+  }
+  *previous = last;
+  *out_size = written;
+  return p;
+}
+
+// Decodes the output of parse_delta_varint_n_u64.  On entry `*count` is the
+// capacity of `results`, on exit it is the number of integers decoded.
+// Returns null for truncated varints or varints over 64 bits, otherwise a
+// pointer to where decoding should continue.
+const uint8_t *decode_delta_varint_u64(uint64_t *results, size_t *count, uint64_t *previous, const uint8_t *in, size_t size);
+inline const uint8_t *decode_delta_varint_u64(uint64_t *results, size_t *count, uint64_t *previous, const uint8_t *in, size_t size) {
+  const uint8_t *end = in + size;
+  uint64_t last = *previous;
+  size_t n = 0;
+  while (n < *count && in < end) {
+    uint64_t zigzag = 0;
+    unsigned shift = 0;
+    while (true) {
+      if (in == end) return NULL;
+      uint8_t byte = *in++;
+      /* The tenth byte only has room for one more bit.                   */
+      if (shift == 63 && byte > 1) return NULL;
+      zigzag |= (uint64_t)(byte & 0x7f) << shift;
+      shift += 7;
+      if (byte < 0x80) break;
+    }
+    last += _UNZIGZAG(zigzag);
+    results[n++] = last;
+  }
+  *previous = last;
+  *count = n;
+  return in;
+}
+
+// Parses delimited unsigned integers and writes the deltas as frame-of-
+// reference blocks to `out`.  Each block has a byte with the number of
+// integers (1-PARSE_INT_BLOCK_SIZE), a byte with the bit width, the smallest
+// delta as 8 little endian bytes, and then the deltas minus the smallest one,
+// bit packed little endian.  Sorted columns with regular steps need few or no
+// bits per integer.  Arguments and return value are as for
+// parse_delta_varint_n_u64.  Only whole blocks are written, so `*out_size`
+// must be at least PARSE_INT_MAX_FOR_BLOCK_BYTES to make progress.
+const char *parse_delta_for_n_u64(uint8_t *out, size_t *out_size, uint64_t *previous, const char *p, size_t size);
+inline const char *parse_delta_for_n_u64(uint8_t *out, size_t *out_size, uint64_t *previous, const char *p, size_t size) {
+  const char *end = p + size;
+  uint64_t deltas[PARSE_INT_BLOCK_SIZE];
+  size_t written = 0;
+  uint64_t last = *previous;
+  while (p < end && *out_size - written >= PARSE_INT_MAX_FOR_BLOCK_BYTES) {
+    size_t count = PARSE_INT_BLOCK_SIZE;
+    if (!_PARSE_BLOCK(deltas, &count, &p, end)) return NULL;
+    if (count == 0) break;
+    /* Deltas are compared as signed, so near-sorted columns with the odd  */
+    /* step backwards still get a narrow range.                            */
+    int64_t min = INT64_MAX, max = INT64_MIN;
+    for (size_t i = 0; i < count; i++) {
+      uint64_t value = deltas[i];
+      deltas[i] = value - last;
+      last = value;
+      if ((int64_t)deltas[i] < min) min = deltas[i];
+      if ((int64_t)deltas[i] > max) max = deltas[i];
+    }
+    uint64_t range = (uint64_t)max - (uint64_t)min;
+    unsigned width = range == 0 ? 0 : 64 - __builtin_clzll(range);
+    out[written++] = (uint8_t)count;
+    out[written++] = (uint8_t)width;
+    _STORE_LE(out + written, (uint64_t)min, 8);
+    written += 8;
+    uint64_t acc = 0;
+    unsigned bits = 0;  /* Bits in acc, always less than 64. */
+    for (size_t i = 0; i < count; i++) {
+      uint64_t value = deltas[i] - (uint64_t)min;
+      acc |= value << bits;
+      bits += width;
+      if (bits >= 64) {
+        _STORE_LE(out + written, acc, 8);
+        written += 8;
+        bits -= 64;
+        acc = bits ? value >> (width - bits) : 0;
+      }
+    }
+    _STORE_LE(out + written, acc, (bits + 7) >> 3);
+    written += (bits + 7) >> 3;
+  }
+  *previous = last;
+  *out_size = written;
+  return p;
+}
+
+// Decodes the output of parse_delta_for_n_u64, a whole block at a time.
+// Arguments and return value are as for decode_delta_varint_u64.  Stops early
+// if the next block does not fit in `results`.  Returns null for truncated or
+// malformed blocks.
+const uint8_t *decode_delta_for_u64(uint64_t *results, size_t *count, uint64_t *previous, const uint8_t *in, size_t size);
+inline const uint8_t *decode_delta_for_u64(uint64_t *results, size_t *count, uint64_t *previous, const uint8_t *in, size_t size) {
+  const uint8_t *end = in + size;
+  uint64_t last = *previous;
+  size_t n = 0;
+  while (in < end) {
+    if (end - in < 10) return NULL;
+    size_t block_count = in[0];
+    unsigned width = in[1];
+    if (block_count == 0 || block_count > PARSE_INT_BLOCK_SIZE || width > 64) return NULL;
+    if (block_count > *count - n) break;
+    size_t packed = (block_count * width + 7) >> 3;
+    if ((size_t)(end - in) - 10 < packed) return NULL;
+    uint64_t min = _LOAD_LE(in + 2, 8);
+    in += 10;
+    uint64_t mask = width == 64 ? ~(uint64_t)0 : ((uint64_t)1 << width) - 1;
+    uint64_t acc = 0;
+    unsigned bits = 0;  /* Unread bits in acc, always less than 64. */
+    for (size_t i = 0; i < block_count; i++) {
+      uint64_t value = acc;
+      if (bits < width) {
+        size_t bytes = packed < 8 ? packed : 8;
+        uint64_t next = _LOAD_LE(in, bytes);
+        in += bytes;
+        packed -= bytes;
+        value = bits ? acc | next << bits : next;
+        acc = width - bits == 64 ? 0 : next >> (width - bits);
+        bits += 64 - width;
+      } else {
+        acc >>= width;
+        bits -= width;
+      }
+      last += (value & mask) + min;
+      results[n++] = last;
+    }
+    in += packed;
+  }
+  *previous = last;
+  *count = n;
+  return in;
+}
+
+#if defined(__SSSE3__)
+
+// Shuffles that gather the four groups of a dotted IPv4 address into 32 bit
+// lanes, right aligned and with leading zeros.  Indexed by the group lengths,
+// 1-3 each, as a base 3 number.
+__m128i _GET_IPV4_SHUFFLE(unsigned index);
+inline __m128i _GET_IPV4_SHUFFLE(unsigned index) {
+  static const __m128i shuffles[81] = {
+      {(int64_t)0x0280808000808080L, (int64_t)0x0680808004808080L},  // 1.1.1.1
+      {(int64_t)0x0280808000808080L, (int64_t)0x0706808004808080L},  // 1.1.1.2
+      {(int64_t)0x0280808000808080L, (int64_t)0x0807068004808080L},  // 1.1.1.3
+      {(int64_t)0x0280808000808080L, (int64_t)0x0780808005048080L},  // 1.1.2.1
+      {(int64_t)0x0280808000808080L, (int64_t)0x0807808005048080L},  // 1.1.2.2
+      {(int64_t)0x0280808000808080L, (int64_t)0x0908078005048080L},  // 1.1.2.3
+      {(int64_t)0x0280808000808080L, (int64_t)0x0880808006050480L},  // 1.1.3.1
+      {(int64_t)0x0280808000808080L, (int64_t)0x0908808006050480L},  // 1.1.3.2
+      {(int64_t)0x0280808000808080L, (int64_t)0x0a09088006050480L},  // 1.1.3.3
+      {(int64_t)0x0302808000808080L, (int64_t)0x0780808005808080L},  // 1.2.1.1
+      {(int64_t)0x0302808000808080L, (int64_t)0x0807808005808080L},  // 1.2.1.2
+      {(int64_t)0x0302808000808080L, (int64_t)0x0908078005808080L},  // 1.2.1.3
+      {(int64_t)0x0302808000808080L, (int64_t)0x0880808006058080L},  // 1.2.2.1
+      {(int64_t)0x0302808000808080L, (int64_t)0x0908808006058080L},  // 1.2.2.2
+      {(int64_t)0x0302808000808080L, (int64_t)0x0a09088006058080L},  // 1.2.2.3
+      {(int64_t)0x0302808000808080L, (int64_t)0x0980808007060580L},  // 1.2.3.1
+      {(int64_t)0x0302808000808080L, (int64_t)0x0a09808007060580L},  // 1.2.3.2
+      {(int64_t)0x0302808000808080L, (int64_t)0x0b0a098007060580L},  // 1.2.3.3
+      {(int64_t)0x0403028000808080L, (int64_t)0x0880808006808080L},  // 1.3.1.1
+      {(int64_t)0x0403028000808080L, (int64_t)0x0908808006808080L},  // 1.3.1.2
+      {(int64_t)0x0403028000808080L, (int64_t)0x0a09088006808080L},  // 1.3.1.3
+      {(int64_t)0x0403028000808080L, (int64_t)0x0980808007068080L},  // 1.3.2.1
+      {(int64_t)0x0403028000808080L, (int64_t)0x0a09808007068080L},  // 1.3.2.2
+      {(int64_t)0x0403028000808080L, (int64_t)0x0b0a098007068080L},  // 1.3.2.3
+      {(int64_t)0x0403028000808080L, (int64_t)0x0a80808008070680L},  // 1.3.3.1
+      {(int64_t)0x0403028000808080L, (int64_t)0x0b0a808008070680L},  // 1.3.3.2
+      {(int64_t)0x0403028000808080L, (int64_t)0x0c0b0a8008070680L},  // 1.3.3.3
+      {(int64_t)0x0380808001008080L, (int64_t)0x0780808005808080L},  // 2.1.1.1
+      {(int64_t)0x0380808001008080L, (int64_t)0x0807808005808080L},  // 2.1.1.2
+      {(int64_t)0x0380808001008080L, (int64_t)0x0908078005808080L},  // 2.1.1.3
+      {(int64_t)0x0380808001008080L, (int64_t)0x0880808006058080L},  // 2.1.2.1
+      {(int64_t)0x0380808001008080L, (int64_t)0x0908808006058080L},  // 2.1.2.2
+      {(int64_t)0x0380808001008080L, (int64_t)0x0a09088006058080L},  // 2.1.2.3
+      {(int64_t)0x0380808001008080L, (int64_t)0x0980808007060580L},  // 2.1.3.1
+      {(int64_t)0x0380808001008080L, (int64_t)0x0a09808007060580L},  // 2.1.3.2
+      {(int64_t)0x0380808001008080L, (int64_t)0x0b0a098007060580L},  // 2.1.3.3
+      {(int64_t)0x0403808001008080L, (int64_t)0x0880808006808080L},  // 2.2.1.1
+      {(int64_t)0x0403808001008080L, (int64_t)0x0908808006808080L},  // 2.2.1.2
+      {(int64_t)0x0403808001008080L, (int64_t)0x0a09088006808080L},  // 2.2.1.3
+      {(int64_t)0x0403808001008080L, (int64_t)0x0980808007068080L},  // 2.2.2.1
+      {(int64_t)0x0403808001008080L, (int64_t)0x0a09808007068080L},  // 2.2.2.2
+      {(int64_t)0x0403808001008080L, (int64_t)0x0b0a098007068080L},  // 2.2.2.3
+      {(int64_t)0x0403808001008080L, (int64_t)0x0a80808008070680L},  // 2.2.3.1
+      {(int64_t)0x0403808001008080L, (int64_t)0x0b0a808008070680L},  // 2.2.3.2
+      {(int64_t)0x0403808001008080L, (int64_t)0x0c0b0a8008070680L},  // 2.2.3.3
+      {(int64_t)0x0504038001008080L, (int64_t)0x0980808007808080L},  // 2.3.1.1
+      {(int64_t)0x0504038001008080L, (int64_t)0x0a09808007808080L},  // 2.3.1.2
+      {(int64_t)0x0504038001008080L, (int64_t)0x0b0a098007808080L},  // 2.3.1.3
+      {(int64_t)0x0504038001008080L, (int64_t)0x0a80808008078080L},  // 2.3.2.1
+      {(int64_t)0x0504038001008080L, (int64_t)0x0b0a808008078080L},  // 2.3.2.2
+      {(int64_t)0x0504038001008080L, (int64_t)0x0c0b0a8008078080L},  // 2.3.2.3
+      {(int64_t)0x0504038001008080L, (int64_t)0x0b80808009080780L},  // 2.3.3.1
+      {(int64_t)0x0504038001008080L, (int64_t)0x0c0b808009080780L},  // 2.3.3.2
+      {(int64_t)0x0504038001008080L, (int64_t)0x0d0c0b8009080780L},  // 2.3.3.3
+      {(int64_t)0x0480808002010080L, (int64_t)0x0880808006808080L},  // 3.1.1.1
+      {(int64_t)0x0480808002010080L, (int64_t)0x0908808006808080L},  // 3.1.1.2
+      {(int64_t)0x0480808002010080L, (int64_t)0x0a09088006808080L},  // 3.1.1.3
+      {(int64_t)0x0480808002010080L, (int64_t)0x0980808007068080L},  // 3.1.2.1
+      {(int64_t)0x0480808002010080L, (int64_t)0x0a09808007068080L},  // 3.1.2.2
+      {(int64_t)0x0480808002010080L, (int64_t)0x0b0a098007068080L},  // 3.1.2.3
+      {(int64_t)0x0480808002010080L, (int64_t)0x0a80808008070680L},  // 3.1.3.1
+      {(int64_t)0x0480808002010080L, (int64_t)0x0b0a808008070680L},  // 3.1.3.2
+      {(int64_t)0x0480808002010080L, (int64_t)0x0c0b0a8008070680L},  // 3.1.3.3
+      {(int64_t)0x0504808002010080L, (int64_t)0x0980808007808080L},  // 3.2.1.1
+      {(int64_t)0x0504808002010080L, (int64_t)0x0a09808007808080L},  // 3.2.1.2
+      {(int64_t)0x0504808002010080L, (int64_t)0x0b0a098007808080L},  // 3.2.1.3
+      {(int64_t)0x0504808002010080L, (int64_t)0x0a80808008078080L},  // 3.2.2.1
+      {(int64_t)0x0504808002010080L, (int64_t)0x0b0a808008078080L},  // 3.2.2.2
+      {(int64_t)0x0504808002010080L, (int64_t)0x0c0b0a8008078080L},  // 3.2.2.3
+      {(int64_t)0x0504808002010080L, (int64_t)0x0b80808009080780L},  // 3.2.3.1
+      {(int64_t)0x0504808002010080L, (int64_t)0x0c0b808009080780L},  // 3.2.3.2
+      {(int64_t)0x0504808002010080L, (int64_t)0x0d0c0b8009080780L},  // 3.2.3.3
+      {(int64_t)0x0605048002010080L, (int64_t)0x0a80808008808080L},  // 3.3.1.1
+      {(int64_t)0x0605048002010080L, (int64_t)0x0b0a808008808080L},  // 3.3.1.2
+      {(int64_t)0x0605048002010080L, (int64_t)0x0c0b0a8008808080L},  // 3.3.1.3
+      {(int64_t)0x0605048002010080L, (int64_t)0x0b80808009088080L},  // 3.3.2.1
+      {(int64_t)0x0605048002010080L, (int64_t)0x0c0b808009088080L},  // 3.3.2.2
+      {(int64_t)0x0605048002010080L, (int64_t)0x0d0c0b8009088080L},  // 3.3.2.3
+      {(int64_t)0x0605048002010080L, (int64_t)0x0c8080800a090880L},  // 3.3.3.1
+      {(int64_t)0x0605048002010080L, (int64_t)0x0d0c80800a090880L},  // 3.3.3.2
+      {(int64_t)0x0605048002010080L, (int64_t)0x0e0d0c800a090880L},  // 3.3.3.3
+  };
+  return shuffles[index];
+}
+
+#endif
+
+// Parses a dotted IPv4 address with 1-3 digits per group, eg. "192.168.001.1",
+// into a 32 bit integer with the first group in the most significant byte.
+// The address is terminated by any char that is not a digit, or by the end of
+// the `size` bytes at `p`.  Returns null if the address is malformed or a
+// group is over 255, otherwise a pointer to the end of the address.
+const char *parse_n_ipv4(uint32_t *result, const char *p, size_t size);
+inline const char *parse_n_ipv4(uint32_t *result, const char *p, size_t size) {
+#if defined(__SSSE3__)
+  /* An address is at most 15 chars, so one unaligned load will do if we   */
+  /* are allowed to read 16 bytes.  Shorter inputs use the scalar path.    */
+  if (size >= 16) {
+    __m128i bytes = _mm_xor_si128(_mm_loadu_si128((const __m128i*)p), _mm_set1_epi8('0'));
+    __m128i is_digit = _mm_cmpeq_epi8(_mm_subs_epu8(bytes, _mm_set1_epi8(9)), _mm_setzero_si128());
+    /* Sentinel bits above the window make sure each ctz below has a bit   */
+    /* to find.  They are not dots, so they fail the dot check.            */
+    unsigned non_digits = (~_mm_movemask_epi8(is_digit) & 0xffff) | 0xf0000;
+    unsigned dots = _mm_movemask_epi8(_mm_cmpeq_epi8(bytes, _mm_set1_epi8('.' ^ '0')));
+    /* The first three non-digits must be dots and the fourth ends the     */
+    /* address.  All four groups must have 1-3 digits.                     */
+    unsigned dot1 = __builtin_ctz(non_digits);
+    non_digits &= non_digits - 1;
+    unsigned dot2 = __builtin_ctz(non_digits);
+    non_digits &= non_digits - 1;
+    unsigned dot3 = __builtin_ctz(non_digits);
+    non_digits &= non_digits - 1;
+    unsigned end = __builtin_ctz(non_digits);
+    unsigned length1 = dot1 - 1, length2 = dot2 - dot1 - 2;
+    unsigned length3 = dot3 - dot2 - 2, length4 = end - dot3 - 2;
+    if (!((dots >> dot1) & (dots >> dot2) & (dots >> dot3) & 1) ||
+        length1 > 2 || length2 > 2 || length3 > 2 || length4 > 2) {
+      return NULL;
+    }
+    /* Convert all four groups at once, as in parse_many_n_u64.            */
+    bytes = _mm_shuffle_epi8(bytes, _GET_IPV4_SHUFFLE(length1 * 27 + length2 * 9 + length3 * 3 + length4));
+    bytes = _mm_maddubs_epi16(bytes, _mm_set1_epi16(0x010a));
+    bytes = _mm_madd_epi16(bytes, _mm_set1_epi32(0x00010064));
+    if (_mm_movemask_epi8(_mm_cmpgt_epi32(bytes, _mm_set1_epi32(255)))) return NULL;
+    /* Pick out the low byte of each lane, first group last.               */
+    bytes = _mm_shuffle_epi8(bytes, _mm_setr_epi8(12, 8, 4, 0, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1));
+    *result = (uint32_t)_mm_cvtsi128_si32(bytes);
+    return p + end;
+  }
+#endif
+  const char *end = p + size;
+  uint32_t address = 0;
+  for (int i = 0; i < 4; i++) {
+    uint8_t group = 0;
+    const char *group_end = parse_n_u8(&group, p, end - p);
+    if (!group_end || group_end - p > 3) return NULL;
+    if (i != 3 && (group_end == end || *group_end != '.')) return NULL;
+    address = (address << 8) | group;
+    p = group_end + 1;
+  }
+  *result = address;
+  return p - 1;
+}
+
+// Parses an IPv4 address as above, followed by a colon and a port number,
+// eg. "192.168.001.1:8080".  Returns null if either is malformed or out of
+// range, otherwise a pointer to the end of the port.  Address and port can be
+// 21 chars, more than one 16 byte load, so the port is parsed separately.
+const char *parse_n_ipv4_port(uint32_t *address, uint16_t *port, const char *p, size_t size);
+inline const char *parse_n_ipv4_port(uint32_t *address, uint16_t *port, const char *p, size_t size) {
+  const char *end = p + size;
+  uint32_t parsed_address;
+  const char *colon = parse_n_ipv4(&parsed_address, p, size);
+  if (!colon || colon == end || *colon != ':') return NULL;
+  uint16_t parsed_port = 0;
+  const char *port_end = parse_n_u16(&parsed_port, colon + 1, end - colon - 1);
+  if (!port_end) return NULL;
+  *address = parsed_address;
+  *port = parsed_port;
+  return port_end;
+}
+
+#if defined(__SSSE3__)
+#define _FOLD_SHORT(fold)                                                    \
+    if (end - p >= 8) {                                                      \
+      __m128i short_lanes;                                                   \
+      unsigned lane_count = _PARSE_SHORT(&short_lanes, &p);                  \
+      if (lane_count != 0) {                                                 \
+        alignas(16) uint32_t lanes[4];                                       \
+        _mm_store_si128((__m128i*)lanes, short_lanes);                       \
+        for (unsigned i = 0; i < lane_count; i++) {                          \
+          uint64_t value = lanes[i];                                         \
+          fold                                                               \
+        }                                                                    \
+        n += lane_count;                                                     \
+        last_end = p - 1;                                                    \
+        continue;                                                            \
+      }                                                                      \
+    }
+#else
+#define _FOLD_SHORT(fold)
+#endif
+
+// Parses delimited integers like parse_many_n_u64, but instead of storing
+// them, runs `fold` on each integer in `value`.  Returns null straight away
+// if `check_args` is false.  On errors, `store_state` is skipped, so state
+// that is loaded into locals is unchanged, but anything `fold` updates in
+// place keeps the integers before the error.
+#define _DEFINE_AGGREGATE(name, declare_args, check_args, load_state, fold, store_state)\
+const char *name declare_args;                                               \
+inline const char *name declare_args {                                       \
+  if (!(check_args)) return NULL;                                            \
+  const char *end = p + size;                                                \
+  const char *last_end = p;                                                  \
+  size_t n = 0;                                                              \
+  /* As in parse_many_n_u64, integers that start before the last non-  */    \
+  /* digit can use the parser without a size.                          */    \
+  const char *tail = end;                                                    \
+  while (tail > p && '0' <= tail[-1] && tail[-1] <= '9') tail--;             \
+  load_state                                                                 \
+  while (n == 0 || p < end) {                                                \
+    _FOLD_SHORT(fold)                                                        \
+    uint64_t value = 0;                                                      \
+    const char *q = p < tail ? parse_u64(&value, p) : parse_n_u64(&value, p, end - p);\
+    if (!q) return NULL;                                                     \
+    fold                                                                     \
+    n++;                                                                     \
+    last_end = q;                                                            \
+    if (q == end) break;                                                     \
+    p = q + 1;                                                               \
+  }                                                                          \
+  store_state                                                                \
+  return last_end;                                                           \
+}
+
+// Parses a run of delimited unsigned integers, as parse_many_n_u64, and adds
+// them to the count, min, max and sum in `*aggregate`.  The integers are never
+// stored anywhere.  Returns null if a field is empty or out-of-range, leaving
+// `*aggregate` unchanged, otherwise a pointer to the end of the last integer.
+_DEFINE_AGGREGATE(aggregate_n_u64,
+    (parse_int_aggregate *aggregate, const char *p, size_t size),
+    true,
+    uint64_t min = aggregate->min;
+    uint64_t max = aggregate->max;
+    uint64_t sum = aggregate->sum;
+    uint64_t sum_high = aggregate->sum_high;,
+    sum += value;
+    sum_high += sum < value;  /* Carry. */
+    if (value < min) min = value;
+    if (value > max) max = value;,
+    aggregate->count += n;
+    aggregate->min = min;
+    aggregate->max = max;
+    aggregate->sum = sum;
+    aggregate->sum_high = sum_high;)
+
+// Parses a run of delimited unsigned integers, as parse_many_n_u64, and counts
+// them in `buckets`.  Each integer goes in bucket `value >> bucket_shift`, or
+// the last bucket if that is out of range.  With a shift of zero, small
+// integers like status codes get a bucket each.  Returns null if
+// `bucket_count` is zero, `bucket_shift` is 64 or more, or a field is empty or
+// out-of-range.  The buckets are counted in place rather than copied, so after
+// an error they include the integers before it.  Otherwise returns a pointer
+// to the end of the last integer.
+_DEFINE_AGGREGATE(aggregate_histogram_n_u64,
+    (uint64_t *buckets, size_t bucket_count, unsigned bucket_shift, const char *p, size_t size),
+    bucket_count != 0 && bucket_shift < 64,
+    ,
+    uint64_t bucket = value >> bucket_shift;
+    buckets[bucket < bucket_count ? bucket : bucket_count - 1]++;,
+    )
+
 #undef _CHUNK
 #undef _CHUNK_SIZE
 #undef _DECLARE
 #undef _DEFINE
+#undef _DEFINE_AGGREGATE
 #undef _DEFINE_STATIC_CONSTS
 #undef _DIGITS_IN_MAP
+#undef _FOLD_SHORT
 #undef _LOAD_FROM
 #undef _MAP_HAS_NON_DIGITS
 #undef _MAP_OF_NON_DIGITS
@@ -1,5 +1,6 @@
 #include <inttypes.h>
 #include <stdio.h>
+#include <string.h>
 
 #include "../parse_int.h"
 
@@ -28,6 +29,10 @@ void fail_##name(const char* str, int size) { \
 }
 
 MAKE_FAIL(int, int)
+MAKE_FAIL(8, int8_t)
+MAKE_FAIL(u8, uint8_t)
+MAKE_FAIL(16, int16_t)
+MAKE_FAIL(u16, uint16_t)
 MAKE_FAIL(unsigned, unsigned)
 MAKE_FAIL(u64, uint64_t)
 MAKE_FAIL(64, int64_t)
@@ -82,6 +87,10 @@ void try_##name(type expected_answer, int expected_chars, const char* str) { \
 }
 
 MAKE_TRY(int, int, "d")
+MAKE_TRY(8, int8_t, PRId8)
+MAKE_TRY(u8, uint8_t, PRIu8)
+MAKE_TRY(16, int16_t, PRId16)
+MAKE_TRY(u16, uint16_t, PRIu16)
 MAKE_TRY(unsigned, unsigned, "u")
 MAKE_TRY(u64, uint64_t, PRIu64)
 MAKE_TRY(64, int64_t, PRId64)
@@ -90,6 +99,196 @@ MAKE_TRY_SIZE(all_n_64, int64_t, PRId64)
 MAKE_TRY_128(u128, __uint128_t)
 #endif
 
+void try_ipv4_size(uint32_t expected_address, int expected_port, int expected_chars, const char* str, size_t size) {
+  uint32_t address = 0;
+  uint16_t port = 0;
+  const char* end = expected_port < 0 ? parse_n_ipv4(&address, str, size) : parse_n_ipv4_port(&address, &port, str, size);
+  if (!end) {
+    printf("***Expected to parse '%s' with size %zd, failed\n", str, size);
+    return;
+  }
+  if (address != expected_address) {
+    printf("***Expected address in '%s' of %08" PRIx32 ", got %08" PRIx32 "\n", str, expected_address, address);
+  }
+  if (expected_port >= 0 && port != expected_port) {
+    printf("***Expected port in '%s' of %d, got %d\n", str, expected_port, port);
+  }
+  if (end - str != expected_chars) {
+    printf("***Expected to take %d characters of '%s', took %zd\n", expected_chars, str, end - str);
+  }
+}
+
+// Tries the exact size, and a buffer padded with spaces to take the 16 byte
+// path.
+void try_ipv4(uint32_t expected_address, int expected_port, int expected_chars, const char* str) {
+  char padded[32];
+  memset(padded, ' ', sizeof(padded));
+  memcpy(padded, str, strlen(str));
+  try_ipv4_size(expected_address, expected_port, expected_chars, str, strlen(str));
+  try_ipv4_size(expected_address, expected_port, expected_chars, padded, sizeof(padded));
+}
+
+void fail_ipv4(const char* str) {
+  uint32_t address = 0;
+  uint16_t port = 0;
+  char padded[32];
+  memset(padded, ' ', sizeof(padded));
+  memcpy(padded, str, strlen(str));
+  if (parse_n_ipv4(&address, str, strlen(str)) || parse_n_ipv4(&address, padded, sizeof(padded))) {
+    printf("***Expected to fail on '%s', passed\n", str);
+  }
+  if (parse_n_ipv4_port(&address, &port, str, strlen(str)) || parse_n_ipv4_port(&address, &port, padded, sizeof(padded))) {
+    printf("***Expected to fail with port on '%s', passed\n", str);
+  }
+}
+
+void try_many(const char* str, int expected_chars, size_t expected_count, const uint64_t* expected_answers) {
+  uint64_t answers[32];
+  size_t count = 32;
+  const char* end = parse_many_n_u64(answers, &count, str, strlen(str));
+  if (!end) {
+    printf("***Expected to parse '%s', failed\n", str);
+    return;
+  }
+  if (end - str != expected_chars) {
+    printf("***Expected to take %d characters of '%s', took %zd\n", expected_chars, str, end - str);
+  }
+  if (count != expected_count) {
+    printf("***Expected %zu integers in '%s', got %zu\n", expected_count, str, count);
+    return;
+  }
+  for (size_t i = 0; i < count; i++) {
+    if (answers[i] != expected_answers[i]) {
+      printf("***Expected answer %zu in '%s' of %" PRIu64 ", got %" PRIu64 "\n", i, str, expected_answers[i], answers[i]);
+    }
+  }
+}
+
+void fail_many(const char* str) {
+  uint64_t answers[32];
+  size_t count = 32;
+  if (parse_many_n_u64(answers, &count, str, strlen(str))) {
+    printf("***Expected to fail on '%s', passed\n", str);
+  }
+}
+
+void try_delta(const char* str, size_t expected_count, const uint64_t* expected_answers) {
+  for (int for_blocks = 0; for_blocks < 2; for_blocks++) {
+    uint8_t encoded[4 * PARSE_INT_MAX_FOR_BLOCK_BYTES];
+    size_t encoded_size = sizeof(encoded);
+    uint64_t previous = 0;
+    const char* end = for_blocks ?
+        parse_delta_for_n_u64(encoded, &encoded_size, &previous, str, strlen(str)) :
+        parse_delta_varint_n_u64(encoded, &encoded_size, &previous, str, strlen(str));
+    if (end != str + strlen(str)) {
+      printf("***Expected to encode all of '%s'\n", str);
+      continue;
+    }
+    uint64_t answers[4 * PARSE_INT_BLOCK_SIZE];
+    size_t count = 4 * PARSE_INT_BLOCK_SIZE;
+    previous = 0;
+    const uint8_t* decoded_end = for_blocks ?
+        decode_delta_for_u64(answers, &count, &previous, encoded, encoded_size) :
+        decode_delta_varint_u64(answers, &count, &previous, encoded, encoded_size);
+    if (decoded_end != encoded + encoded_size) {
+      printf("***Expected to decode all of '%s'\n", str);
+    }
+    if (count != expected_count) {
+      printf("***Expected %zu integers in '%s', decoded %zu\n", expected_count, str, count);
+      continue;
+    }
+    for (size_t i = 0; i < count; i++) {
+      if (answers[i] != expected_answers[i]) {
+        printf("***Expected decoded answer %zu in '%s' of %" PRIu64 ", got %" PRIu64 "\n", i, str, expected_answers[i], answers[i]);
+      }
+    }
+  }
+}
+
+// Encodes and decodes a piece at a time, carrying `previous` across calls.
+void try_delta_streaming(const char* str, size_t expected_count, const uint64_t* expected_answers,
+                         size_t out_size, size_t decode_count) {
+  for (int for_blocks = 0; for_blocks < 2; for_blocks++) {
+    uint8_t encoded[8 * PARSE_INT_MAX_FOR_BLOCK_BYTES];
+    size_t encoded_size = 0;
+    uint64_t previous = 1000;
+    const char* p = str;
+    const char* end = str + strlen(str);
+    while (p < end) {
+      size_t size = out_size;
+      p = for_blocks ?
+          parse_delta_for_n_u64(encoded + encoded_size, &size, &previous, p, end - p) :
+          parse_delta_varint_n_u64(encoded + encoded_size, &size, &previous, p, end - p);
+      if (!p || size == 0) {
+        printf("***Expected to encode in pieces of %zu bytes\n", out_size);
+        return;
+      }
+      encoded_size += size;
+    }
+    if (previous != expected_answers[expected_count - 1]) {
+      printf("***Expected previous integer to be the last one\n");
+    }
+    uint64_t answers[4 * PARSE_INT_BLOCK_SIZE];
+    size_t count = 0;
+    previous = 1000;
+    const uint8_t* in = encoded;
+    while (in < encoded + encoded_size) {
+      /* Blocks are decoded whole, so they need room for a full block. */
+      size_t pieces = for_blocks && decode_count < PARSE_INT_BLOCK_SIZE ? PARSE_INT_BLOCK_SIZE : decode_count;
+      if (pieces > 4 * PARSE_INT_BLOCK_SIZE - count) pieces = 4 * PARSE_INT_BLOCK_SIZE - count;
+      in = for_blocks ?
+          decode_delta_for_u64(answers + count, &pieces, &previous, in, encoded + encoded_size - in) :
+          decode_delta_varint_u64(answers + count, &pieces, &previous, in, encoded + encoded_size - in);
+      if (!in || pieces == 0) {
+        printf("***Expected to decode in pieces of %zu integers\n", decode_count);
+        return;
+      }
+      count += pieces;
+    }
+    if (count != expected_count) {
+      printf("***Expected %zu integers, decoded %zu\n", expected_count, count);
+      continue;
+    }
+    for (size_t i = 0; i < count; i++) {
+      if (answers[i] != expected_answers[i]) {
+        printf("***Expected decoded answer %zu of %" PRIu64 ", got %" PRIu64 "\n", i, expected_answers[i], answers[i]);
+      }
+    }
+  }
+}
+
+void fail_decode(int for_blocks, const uint8_t* in, size_t size) {
+  uint64_t answers[PARSE_INT_BLOCK_SIZE];
+  size_t count = PARSE_INT_BLOCK_SIZE;
+  uint64_t previous = 0;
+  if (for_blocks ? decode_delta_for_u64(answers, &count, &previous, in, size) :
+                   decode_delta_varint_u64(answers, &count, &previous, in, size)) {
+    printf("***Expected to fail decoding %zu bytes with %s\n", size, for_blocks ? "blocks" : "varints");
+  }
+}
+
+void try_aggregate(const char* str, uint64_t count, uint64_t min, uint64_t max, uint64_t sum, uint64_t sum_high) {
+  parse_int_aggregate aggregate = PARSE_INT_AGGREGATE_INIT;
+  if (!aggregate_n_u64(&aggregate, str, strlen(str))) {
+    printf("***Expected to aggregate '%s', failed\n", str);
+    return;
+  }
+  if (aggregate.count != count || aggregate.min != min || aggregate.max != max ||
+      aggregate.sum != sum || aggregate.sum_high != sum_high) {
+    printf("***Wrong aggregate of '%s'\n", str);
+  }
+}
+
+void fail_aggregate(const char* str) {
+  parse_int_aggregate aggregate = PARSE_INT_AGGREGATE_INIT;
+  if (aggregate_n_u64(&aggregate, str, strlen(str))) {
+    printf("***Expected to fail on '%s', passed\n", str);
+  }
+  if (aggregate.count != 0 || aggregate.sum != 0) {
+    printf("***Expected unchanged aggregate on '%s'\n", str);
+  }
+}
+
 int main() {
   try_int(123, 3, "123");
   try_int(321, 3, "321");
@@ -116,6 +315,33 @@ int main() {
   fail_unsigned("4294967300");
   fail_unsigned("9999999999");
 
+  try_8(127, 3, "127");
+  try_8(-128, 4, "-128");
+  try_8(42, 20, "00000000000000000042");
+  fail_8("128");
+  fail_8("-129");
+  try_u8(255, 3, "255");
+  try_u8(255, 10, "0000000255");
+  fail_u8("256");
+  fail_u8("-1");
+  fail_u8("99999999999");
+  fail_u8("1000");
+  try_u8(1, 4, "0001");
+  try_16(32767, 5, "32767");
+  try_16(-32768, 6, "-32768");
+  fail_16("32768");
+  fail_16("-32769");
+  try_u16(65535, 5, "65535");
+  try_u16(8080, 4, "8080:");
+  fail_u16("65536");
+  fail_u16("100000");
+
+  int64_t first = 0;
+  const char *comma = "12,3";
+  if (parse_n_64(&first, comma, 4) != comma + 2 || first != 12) {
+    printf("***Expected parse_n to stop at the comma in '%s'\n", comma);
+  }
+
   const char *pi = "3.14159";
   try_int(3, 1, pi);
   try_int(14159, 5, pi + 2);
@@ -183,4 +409,134 @@ int main() {
   fail_u128("340282366920938463463374607431768211456");
   fail_u128("999999999999999999999999999999999999999");
 #endif
+
+  try_ipv4(0xc0a80101, -1, 13, "192.168.001.1");
+  try_ipv4(0xc0a80101, 8080, 18, "192.168.001.1:8080");
+  try_ipv4(0, -1, 7, "0.0.0.0");
+  try_ipv4(0xffffffff, -1, 15, "255.255.255.255");
+  try_ipv4(0x01020304, -1, 15, "001.002.003.004 and more");
+  try_ipv4(0x0a000001, 65535, 14, "10.0.0.1:65535");
+  try_ipv4(0x01020304, -1, 7, "1.2.3.4.5");
+  fail_ipv4("256.1.1.1");
+  fail_ipv4("1.2.3");
+  fail_ipv4("1..2.3");
+  fail_ipv4(".1.2.3");
+  fail_ipv4("1234.1.1.1");
+  fail_ipv4("1.1.1.1234");
+  fail_ipv4("1.1.1.");
+  fail_ipv4("");
+  fail_ipv4("1234567890123456789");
+  fail_ipv4("1.2");
+  fail_ipv4("1.2.3456789012345678");
+  uint32_t address;
+  uint16_t port;
+  if (parse_n_ipv4_port(&address, &port, "10.0.0.1:65536", 14)) printf("***Expected to fail on port 65536\n");
+  if (parse_n_ipv4_port(&address, &port, "10.0.0.1:", 9)) printf("***Expected to fail on missing port\n");
+  if (parse_n_ipv4_port(&address, &port, "10.0.0.1", 8)) printf("***Expected to fail on missing colon\n");
+  /* The size ends the address even if more digits follow. */
+  try_ipv4_size(0x01020304, -1, 7, "1.2.3.456", 7);
+  if (parse_n_ipv4(&address, "1.2.3.4", 5)) printf("***Expected to fail on truncated address\n");
+  try_ipv4_size(0x0a000001, 80, 11, "10.0.0.1:8080", 11);
+
+  const uint64_t statuses[] = {200, 404, 8080, 1};
+  try_many("200,404,8080,1", 14, 4, statuses);
+  try_many("200,404,8080,1,", 14, 4, statuses);
+  try_many("200 404\n8080;1", 14, 4, statuses);
+  const uint64_t counts[] = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12};
+  try_many("1,2,3,4,5,6,7,8,9,10,11,12", 26, 12, counts);
+  try_many("001,2,3,04,5,6,7,8,9,0010,11,12", 31, 12, counts);
+  const uint64_t mixed[] = {98324923847LLU, 8, 12345, 0, 18446744073709551615LLU, 7};
+  try_many("98324923847,8,12345,0,18446744073709551615,7", 44, 6, mixed);
+  fail_many("");
+  fail_many(",1");
+  fail_many("1,,2,3,4,5,6,7,8");
+  fail_many("1,2,3,18446744073709551616,4");
+
+  try_delta("200,404,8080,1", 4, statuses);
+  try_delta("1,2,3,4,5,6,7,8,9,10,11,12,", 12, counts);
+  try_delta("98324923847,8,12345,0,18446744073709551615,7", 6, mixed);
+  char column[4 * PARSE_INT_BLOCK_SIZE * 15];
+  uint64_t timestamps[4 * PARSE_INT_BLOCK_SIZE - 3];
+  size_t size = 0;
+  for (size_t i = 0; i < 4 * PARSE_INT_BLOCK_SIZE - 3; i++) {
+    timestamps[i] = 1653900000000LLU + i * 1000 + (i % 3) * 7 - (i % 5 == 0) * 2000;
+    size += sprintf(column + size, "%" PRIu64 ",", timestamps[i]);
+  }
+  try_delta(column, 4 * PARSE_INT_BLOCK_SIZE - 3, timestamps);
+  try_delta_streaming(column, 4 * PARSE_INT_BLOCK_SIZE - 3, timestamps, PARSE_INT_MAX_FOR_BLOCK_BYTES, 3);
+  try_delta_streaming(column, 4 * PARSE_INT_BLOCK_SIZE - 3, timestamps, PARSE_INT_MAX_FOR_BLOCK_BYTES + 37, PARSE_INT_BLOCK_SIZE + 72);
+
+  /* Too little output space or too few results for a block make no progress. */
+  uint8_t small[PARSE_INT_MAX_FOR_BLOCK_BYTES];
+  size_t small_size = PARSE_INT_MAX_VARINT_BYTES - 1;
+  uint64_t previous = 0;
+  if (parse_delta_varint_n_u64(small, &small_size, &previous, column, strlen(column)) != column || small_size != 0) {
+    printf("***Expected no progress with %d bytes of varint space\n", PARSE_INT_MAX_VARINT_BYTES - 1);
+  }
+  small_size = PARSE_INT_MAX_FOR_BLOCK_BYTES - 1;
+  if (parse_delta_for_n_u64(small, &small_size, &previous, column, strlen(column)) != column || small_size != 0) {
+    printf("***Expected no progress with %d bytes of block space\n", PARSE_INT_MAX_FOR_BLOCK_BYTES - 1);
+  }
+  small_size = sizeof(small);
+  parse_delta_for_n_u64(small, &small_size, &previous, column, strlen(column));
+  uint64_t few[PARSE_INT_BLOCK_SIZE - 1];
+  size_t few_count = PARSE_INT_BLOCK_SIZE - 1;
+  previous = 0;
+  if (decode_delta_for_u64(few, &few_count, &previous, small, small_size) != small || few_count != 0) {
+    printf("***Expected no progress decoding a block into %d results\n", PARSE_INT_BLOCK_SIZE - 1);
+  }
+
+  const uint8_t truncated_varint[] = {0x80};
+  fail_decode(false, truncated_varint, sizeof(truncated_varint));
+  const uint8_t long_varint[] = {0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f};
+  fail_decode(false, long_varint, sizeof(long_varint));
+  const uint8_t longer_varint[] = {0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x81, 0x00};
+  fail_decode(false, longer_varint, sizeof(longer_varint));
+  const uint8_t max_varint[] = {0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x01};
+  uint64_t max_answer = 0;
+  size_t max_count = 1;
+  previous = 0;
+  if (!decode_delta_varint_u64(&max_answer, &max_count, &previous, max_varint, sizeof(max_varint)) ||
+      max_count != 1 || max_answer != 9223372036854775807LLU) {
+    printf("***Expected to decode the largest varint\n");
+  }
+  const uint8_t short_header[] = {1, 0, 0, 0, 0};
+  fail_decode(true, short_header, sizeof(short_header));
+  const uint8_t empty_block[] = {0, 0, 0, 0, 0, 0, 0, 0, 0, 0};
+  fail_decode(true, empty_block, sizeof(empty_block));
+  const uint8_t wide_block[] = {1, 65, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0};
+  fail_decode(true, wide_block, sizeof(wide_block));
+  const uint8_t truncated_block[] = {3, 8, 0, 0, 0, 0, 0, 0, 0, 0, 1, 2};
+  fail_decode(true, truncated_block, sizeof(truncated_block));
+
+  try_aggregate("200,404,8080,1", 4, 1, 8080, 8685, 0);
+  try_aggregate("1,2,3,4,5,6,7,8,9,10,11,12,", 12, 1, 12, 78, 0);
+  try_aggregate("7", 1, 7, 7, 7, 0);
+  try_aggregate("98324923847,8,12345,0,18446744073709551615,7", 6, 0, 18446744073709551615LLU, 98324936206LLU, 1);
+  try_aggregate("18446744073709551615,18446744073709551615,18446744073709551615", 3, 18446744073709551615LLU, 18446744073709551615LLU, 18446744073709551613LLU, 2);
+  fail_aggregate("");
+  fail_aggregate("1,2,,3,4,5,6,7,8");
+  fail_aggregate("1,2,3,4,5,6,7,8,18446744073709551616");
+  uint64_t buckets[5] = {0};
+  const char* sizes = "1,300,255,256,1000,2,3,511,512";
+  if (!aggregate_histogram_n_u64(buckets, 5, 8, sizes, strlen(sizes)) ||
+      buckets[0] != 4 || buckets[1] != 3 || buckets[2] != 1 || buckets[3] != 1 || buckets[4] != 0) {
+    printf("***Wrong histogram\n");
+  }
+  uint64_t partial[4] = {0};
+  const char* bad = "1,2,3,4,5,6,7,8,9,,1";
+  if (aggregate_histogram_n_u64(partial, 4, 0, bad, strlen(bad))) {
+    printf("***Expected to fail on '%s', passed\n", bad);
+  }
+  if (partial[0] + partial[1] + partial[2] + partial[3] != 9 || partial[3] != 7) {
+    printf("***Expected the integers before the error in the buckets\n");
+  }
+  uint64_t untouched = 0;
+  if (aggregate_histogram_n_u64(&untouched, 0, 0, "1,2,3", 5) || untouched != 0) {
+    printf("***Expected to fail with no buckets\n");
+  }
+  uint64_t shifted[2] = {0, 0};
+  if (aggregate_histogram_n_u64(shifted, 2, 64, "0,1,2,3", 7) || shifted[0] != 0 || shifted[1] != 0) {
+    printf("***Expected to fail with a shift of 64\n");
+  }
 }